@@ -78,14 +78,17 @@
 #include <alpaka/core/BarrierThread.hpp>
 #include <alpaka/core/Common.hpp>
 #include <alpaka/core/ConcurrentExecPool.hpp>
+#include <alpaka/core/ConcurrentExecPoolWorkStealing.hpp>
 #include <alpaka/core/Cuda.hpp>
 #include <alpaka/core/Debug.hpp>
 #include <alpaka/core/Fibers.hpp>
+#include <alpaka/core/FreeListAllocator.hpp>
 #include <alpaka/core/OpenMp.hpp>
 #include <alpaka/core/Positioning.hpp>
 #include <alpaka/core/Unroll.hpp>
 #include <alpaka/core/Utility.hpp>
 #include <alpaka/core/Vectorize.hpp>
+#include <alpaka/core/WorkStealingDeque.hpp>
 //-----------------------------------------------------------------------------
 // dev
 #include <alpaka/dev/DevCudaRt.hpp>
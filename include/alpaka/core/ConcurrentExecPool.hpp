@@ -28,11 +28,11 @@
 // Therefore, we can not even parse those parts when compiling device code.
 //-----------------------------------------------------------------------------
 #include <alpaka/core/Common.hpp>
+#include <alpaka/core/FreeListAllocator.hpp>
 
 #include <boost/predef.h>
 #include <boost/config.hpp>
 
-#include <queue>
 #include <mutex>
 #include <stdexcept>
 #include <vector>
@@ -49,54 +49,80 @@ namespace alpaka
         namespace detail
         {
             //#############################################################################
+            //! A thread safe intrusive First In First Out (FIFO) queue.
+            //!
+            //! The queue does not own the elements and does not allocate any memory.
+            //!
+            //! \tparam T The element type. It is required to have a member "T * m_pNext" used to link the elements.
             template<
                 typename T>
-            class ThreadSafeQueue :
-                private std::queue<T>
+            class ThreadSafeQueue
             {
             public:
                 //-----------------------------------------------------------------------------
-                ThreadSafeQueue()
+                ThreadSafeQueue() :
+                    m_Mutex(),
+                    m_pHead(nullptr),
+                    m_pTail(nullptr)
                 {}
                 //-----------------------------------------------------------------------------
                 //! \return If the queue is empty.
                 auto empty() const
                 -> bool
                 {
-                    return std::queue<T>::empty();
+                    std::lock_guard<std::mutex> lk(m_Mutex);
+
+                    return m_pHead == nullptr;
                 }
                 //-----------------------------------------------------------------------------
-                //! Pushes the given value onto the back of the queue.
+                //! Pushes the given element onto the back of the queue.
                 auto push(
-                    T && t)
+                    T * const t)
                 -> void
                 {
+                    t->m_pNext = nullptr;
+
                     std::lock_guard<std::mutex> lk(m_Mutex);
 
-                    std::queue<T>::push(std::forward<T>(t));
+                    if(m_pTail)
+                    {
+                        m_pTail->m_pNext = t;
+                    }
+                    else
+                    {
+                        m_pHead = t;
+                    }
+                    m_pTail = t;
                 }
                 //-----------------------------------------------------------------------------
-                //! Pops the given value from the front of the queue.
+                //! Pops the element from the front of the queue.
                 auto pop(
-                    T & t)
+                    T * & t)
                 -> bool
                 {
                     std::lock_guard<std::mutex> lk(m_Mutex);
 
-                    if(std::queue<T>::empty())
+                    if(m_pHead == nullptr)
                     {
                         return false;
                     }
                     else
                     {
-                        t = std::queue<T>::front();
-                        std::queue<T>::pop();
+                        t = m_pHead;
+                        m_pHead = t->m_pNext;
+                        if(m_pHead == nullptr)
+                        {
+                            m_pTail = nullptr;
+                        }
+                        t->m_pNext = nullptr;
                         return true;
                     }
                 }
 
             private:
-                std::mutex m_Mutex;
+                std::mutex mutable m_Mutex;
+                T * m_pHead;
+                T * m_pTail;
             };
 
             //#############################################################################
@@ -110,9 +136,18 @@ namespace alpaka
             class ITaskPkg
             {
             public:
+                //-----------------------------------------------------------------------------
+                ITaskPkg() :
+                    m_pNext(nullptr)
+                {}
                 //-----------------------------------------------------------------------------
                 virtual ~ITaskPkg() = default;
 
+                //-----------------------------------------------------------------------------
+                //! Destroys this task and gives its memory back to the allocator it has been created with.
+                virtual auto destroy() noexcept
+                -> void = 0;
+
                 //-----------------------------------------------------------------------------
                 //! Runs this task.
                 auto runTask() noexcept
@@ -145,6 +180,7 @@ namespace alpaka
                     std::exception_ptr const & exceptPtr)
                 -> void = 0;
 #endif
+                ITaskPkg * m_pNext;  //!< The link used by ThreadSafeQueue.
             };
 #if BOOST_COMP_CLANG
     #pragma clang diagnostic pop
@@ -164,12 +200,25 @@ namespace alpaka
                 public ITaskPkg
             {
             public:
+                using Allocator = FreeListAllocator<TaskPkg>;
+
                 //-----------------------------------------------------------------------------
                 TaskPkg(
+                    Allocator const & alloc,
                     TFnObj && func) :
-                        m_Promise(),
-                        m_FnObj(std::forward<TFnObj>(func))
+                        m_Promise(std::allocator_arg, alloc),
+                        m_FnObj(std::forward<TFnObj>(func)),
+                        m_Alloc(alloc)
                 {}
+                //-----------------------------------------------------------------------------
+                //! Destroys this task and gives its memory back to the allocator it has been created with.
+                virtual auto destroy() noexcept
+                -> void final
+                {
+                    Allocator alloc(m_Alloc);
+                    this->~TaskPkg();
+                    std::allocator_traits<Allocator>::deallocate(alloc, this, 1u);
+                }
 
             private:
                 //-----------------------------------------------------------------------------
@@ -196,6 +245,7 @@ namespace alpaka
                 // NOTE: To avoid invalid memory accesses to memory of a different thread
                 // `std::remove_reference` enforces the function object to be copied.
                 typename std::remove_reference<TFnObj>::type m_FnObj;
+                Allocator m_Alloc;
             };
 
             //#############################################################################
@@ -213,12 +263,25 @@ namespace alpaka
                 public ITaskPkg
             {
             public:
+                using Allocator = FreeListAllocator<TaskPkg>;
+
                 //-----------------------------------------------------------------------------
                 TaskPkg(
+                    Allocator const & alloc,
                     TFnObj && func) :
-                        m_Promise(),
-                        m_FnObj(std::forward<TFnObj>(func))
+                        m_Promise(std::allocator_arg, alloc),
+                        m_FnObj(std::forward<TFnObj>(func)),
+                        m_Alloc(alloc)
                 {}
+                //-----------------------------------------------------------------------------
+                //! Destroys this task and gives its memory back to the allocator it has been created with.
+                virtual auto destroy() noexcept
+                -> void final
+                {
+                    Allocator alloc(m_Alloc);
+                    this->~TaskPkg();
+                    std::allocator_traits<Allocator>::deallocate(alloc, this, 1u);
+                }
 
             private:
                 //-----------------------------------------------------------------------------
@@ -246,8 +309,38 @@ namespace alpaka
                 // NOTE: To avoid invalid memory accesses to memory of a different thread
                 // `std::remove_reference` enforces the function object to be copied.
                 typename std::remove_reference<TFnObj>::type m_FnObj;
+                Allocator m_Alloc;
             };
 
+            //-----------------------------------------------------------------------------
+            //! Creates a task package within memory of the given free list.
+            //!
+            //! \tparam TTaskPkg The type of the task package.
+            //! \param spFreeList The free list used for the task package and the shared state of its promise.
+            //! \param fnObj The function object executed by the task package.
+            template<
+                typename TTaskPkg,
+                typename TFnObj>
+            auto createTaskPkg(
+                std::shared_ptr<FreeList> const & spFreeList,
+                TFnObj && fnObj)
+            -> TTaskPkg *
+            {
+                using Allocator = typename TTaskPkg::Allocator;
+
+                Allocator alloc(spFreeList);
+                auto const pTaskPkg(std::allocator_traits<Allocator>::allocate(alloc, 1u));
+                try
+                {
+                    return ::new (static_cast<void *>(pTaskPkg)) TTaskPkg(alloc, std::forward<TFnObj>(fnObj));
+                }
+                catch(...)
+                {
+                    std::allocator_traits<Allocator>::deallocate(alloc, pTaskPkg, 1u);
+                    throw;
+                }
+            }
+
             //#############################################################################
             //! ConcurrentExecPool using yield.
             //!
@@ -278,6 +371,7 @@ namespace alpaka
                     TSize concurrentExecutionCount) :
                     m_vConcurrentExecs(),
                     m_qTasks(),
+                    m_spFreeList(std::make_shared<FreeList>()),
                     m_bShutdownFlag(false)
                 {
                     if(concurrentExecutionCount < 1)
@@ -312,7 +406,7 @@ namespace alpaka
 
                     joinAllConcurrentExecs();
 
-                    auto currentTaskPackage(std::shared_ptr<ITaskPkg>{nullptr});
+                    ITaskPkg * currentTaskPackage(nullptr);
 
                     // Signal to each incomplete task that it will not complete due to pool destruction.
                     while(popTask(currentTaskPackage))
@@ -322,6 +416,7 @@ namespace alpaka
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_CUDA_DEVICE)
                         currentTaskPackage->setException(std::make_exception_ptr(except));
 #endif
+                        currentTaskPackage->destroy();
                     }
                 }
 
@@ -353,12 +448,11 @@ namespace alpaka
                     using FnObjReturn = decltype(task(args...));
                     using TaskPackage = TaskPkg<TPromise, decltype(boundTask), FnObjReturn>;
 
-                    auto pTaskPackage(new TaskPackage(std::move(boundTask)));
-                    std::shared_ptr<ITaskPkg> upTaskPackage(pTaskPackage);
+                    auto const pTaskPackage(createTaskPkg<TaskPackage>(m_spFreeList, std::move(boundTask)));
 
                     auto future(pTaskPackage->m_Promise.get_future());
 
-                    m_qTasks.push(std::move(upTaskPackage));
+                    m_qTasks.push(pTaskPackage);
 
                     return future;
                 }
@@ -370,6 +464,24 @@ namespace alpaka
                     return m_vConcurrentExecs.size();
                 }
                 //-----------------------------------------------------------------------------
+                //! Adds concurrent executors until the pool contains at least the given number of them.
+                //! NOTE: This must not be called concurrently with itself or getConcurrentExecutionCount.
+                //!
+                //! \param concurrentExecutionCount The minimum number of concurrent executors.
+                auto reserveConcurrentExecs(
+                    TSize concurrentExecutionCount)
+                -> void
+                {
+                    auto const count(static_cast<std::size_t>(concurrentExecutionCount));
+
+                    m_vConcurrentExecs.reserve(count);
+
+                    while(m_vConcurrentExecs.size() < count)
+                    {
+                        m_vConcurrentExecs.emplace_back(std::bind(&ConcurrentExecPool::concurrentExecFn, this));
+                    }
+                }
+                //-----------------------------------------------------------------------------
                 //! \return If the work queue is empty.
                 auto isQueueEmpty() const
                 -> bool
@@ -385,12 +497,13 @@ namespace alpaka
                     // Checks whether pool is being destroyed, if so, stop running.
                     while(!m_bShutdownFlag.load(std::memory_order_relaxed))
                     {
-                        auto currentTaskPackage(std::shared_ptr<ITaskPkg>{nullptr});
+                        ITaskPkg * currentTaskPackage(nullptr);
 
                         // Use popTask so we only ever have one reference to the ITaskPkg
                         if(popTask(currentTaskPackage))
                         {
                             currentTaskPackage->runTask();
+                            currentTaskPackage->destroy();
                         }
                         else
                         {
@@ -411,7 +524,7 @@ namespace alpaka
                 //-----------------------------------------------------------------------------
                 //! Pops a task from the queue.
                 auto popTask(
-                    std::shared_ptr<ITaskPkg> & out)
+                    ITaskPkg * & out)
                 -> bool
                 {
                     if(m_qTasks.pop(out))
@@ -423,7 +536,8 @@ namespace alpaka
 
             private:
                 std::vector<TConcurrentExec> m_vConcurrentExecs;
-                ThreadSafeQueue<std::shared_ptr<ITaskPkg>> m_qTasks;
+                ThreadSafeQueue<ITaskPkg> m_qTasks;
+                std::shared_ptr<FreeList> m_spFreeList;    //!< The memory used for the task packages and their promises.
                 std::atomic<bool> m_bShutdownFlag;
             };
 
@@ -462,6 +576,7 @@ namespace alpaka
                     TSize concurrentExecutionCount) :
                     m_vConcurrentExecs(),
                     m_qTasks(),
+                    m_spFreeList(std::make_shared<FreeList>()),
                     m_mtxWakeup(),
                     m_cvWakeup(),
                     m_bShutdownFlag(false)
@@ -504,7 +619,7 @@ namespace alpaka
 
                     joinAllConcurrentExecs();
 
-                    auto currentTaskPackage(std::shared_ptr<ITaskPkg>{nullptr});
+                    ITaskPkg * currentTaskPackage(nullptr);
 
                     // Signal to each incomplete task that it will not complete due to pool destruction.
                     while(popTask(currentTaskPackage))
@@ -514,6 +629,7 @@ namespace alpaka
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_CUDA_DEVICE)
                         currentTaskPackage->setException(std::make_exception_ptr(except));
 #endif
+                        currentTaskPackage->destroy();
                     }
                 }
 
@@ -545,14 +661,13 @@ namespace alpaka
                     using FnObjReturn = decltype(task(args...));
                     using TaskPackage = TaskPkg<TPromise, decltype(boundTask), FnObjReturn>;
 
-                    auto pTaskPackage(new TaskPackage(std::move(boundTask)));
-                    std::shared_ptr<ITaskPkg> upTaskPackage(pTaskPackage);
+                    auto const pTaskPackage(createTaskPkg<TaskPackage>(m_spFreeList, std::move(boundTask)));
 
                     auto future(pTaskPackage->m_Promise.get_future());
 
                     {
                         std::lock_guard<TMutex> lock(m_mtxWakeup);
-                        m_qTasks.push(std::move(upTaskPackage));
+                        m_qTasks.push(pTaskPackage);
 
                         m_cvWakeup.notify_one();
                     }
@@ -567,6 +682,24 @@ namespace alpaka
                     return m_vConcurrentExecs.size();
                 }
                 //-----------------------------------------------------------------------------
+                //! Adds concurrent executors until the pool contains at least the given number of them.
+                //! NOTE: This must not be called concurrently with itself or getConcurrentExecutionCount.
+                //!
+                //! \param concurrentExecutionCount The minimum number of concurrent executors.
+                auto reserveConcurrentExecs(
+                    TSize concurrentExecutionCount)
+                -> void
+                {
+                    auto const count(static_cast<std::size_t>(concurrentExecutionCount));
+
+                    m_vConcurrentExecs.reserve(count);
+
+                    while(m_vConcurrentExecs.size() < count)
+                    {
+                        m_vConcurrentExecs.emplace_back(std::bind(&ConcurrentExecPool::concurrentExecFn, this));
+                    }
+                }
+                //-----------------------------------------------------------------------------
                 //! \return If the work queue is empty.
                 auto isQueueEmpty() const
                 -> bool
@@ -582,12 +715,13 @@ namespace alpaka
                     // Checks whether pool is being destroyed, if so, stop running (lazy check without mutex).
                     while(!m_bShutdownFlag)
                     {
-                        auto currentTaskPackage(std::shared_ptr<ITaskPkg>{nullptr});
+                        ITaskPkg * currentTaskPackage(nullptr);
 
                         // Use popTask so we only ever have one reference to the ITaskPkg
                         if(popTask(currentTaskPackage))
                         {
                             currentTaskPackage->runTask();
+                            currentTaskPackage->destroy();
                         }
                         {
                             std::unique_lock<TMutex> lock(m_mtxWakeup);
@@ -617,7 +751,7 @@ namespace alpaka
                 //-----------------------------------------------------------------------------
                 //! Pops a task from the queue.
                 auto popTask(
-                    std::shared_ptr<ITaskPkg> & out)
+                    ITaskPkg * & out)
                 -> bool
                 {
                     if(m_qTasks.pop(out))
@@ -629,7 +763,8 @@ namespace alpaka
 
             private:
                 std::vector<TConcurrentExec> m_vConcurrentExecs;
-                ThreadSafeQueue<std::shared_ptr<ITaskPkg>> m_qTasks;
+                ThreadSafeQueue<ITaskPkg> m_qTasks;
+                std::shared_ptr<FreeList> m_spFreeList;    //!< The memory used for the task packages and their promises.
 
                 TMutex m_mtxWakeup;
                 TCondVar m_cvWakeup;
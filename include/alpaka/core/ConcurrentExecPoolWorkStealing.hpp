@@ -0,0 +1,355 @@
+/**
+* \file
+* Copyright 2017 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/ConcurrentExecPool.hpp>
+#include <alpaka/core/FreeListAllocator.hpp>
+#include <alpaka/core/WorkStealingDeque.hpp>
+
+#include <boost/predef.h>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! ConcurrentExecPool using a work-stealing scheduler.
+            //!
+            //! Each concurrent executor owns a lock-free Chase-Lev deque for the tasks enqueued by itself
+            //! and an inbox for the tasks enqueued by other threads. Tasks enqueued from outside of the pool are distributed round robin
+            //! over the inboxes so that the producers do not all contend for a single mutex.
+            //! Idle concurrent executors steal from the others, yield a few times and finally go to sleep on a condition variable.
+            //!
+            //! This pool relies on thread local storage to identify its concurrent executors.
+            //! Therefore, it can only be used with concurrent execution types that are real threads (for example std::thread).
+            //!
+            //! \tparam TConcurrentExec The type of concurrent executor (for example std::thread).
+            //! \tparam TPromise The promise type returned by the task.
+            //! \tparam TYield The type is required to have a static method "void yield()" to yield the current thread if there is no work.
+            //! \tparam TMutex The mutex type used for locking threads.
+            //! \tparam TCondVar The condition variable type used to make the threads wait if there is no work.
+            template<
+                typename TSize,
+                typename TConcurrentExec,
+                template<typename TFnObjReturn> class TPromise,
+                typename TYield,
+                typename TMutex,
+                typename TCondVar>
+            class ConcurrentExecPoolWorkStealing final
+            {
+            private:
+                //#############################################################################
+                //! The state of a single concurrent executor.
+                struct Worker
+                {
+                    //-----------------------------------------------------------------------------
+                    explicit Worker(
+                        ConcurrentExecPoolWorkStealing const * const pPool) :
+                            m_pPool(pPool),
+                            m_dqTasks(),
+                            m_qInbox()
+                    {}
+
+                    ConcurrentExecPoolWorkStealing const * const m_pPool;
+                    WorkStealingDeque<ITaskPkg *> m_dqTasks;        //!< The tasks enqueued by this concurrent executor itself.
+                    ThreadSafeQueue<ITaskPkg> m_qInbox;             //!< The tasks enqueued by other threads.
+                };
+
+                //! The number of times an idle concurrent executor yields before going to sleep.
+                static constexpr std::size_t s_yieldCountMax = 64u;
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! Creates a concurrent executor pool with a specific number of concurrent executors.
+                //!
+                //! \param concurrentExecutionCount
+                //!    The guaranteed number of concurrent executors used in the pool.
+                //!    This is also the maximum number of tasks worked on concurrently.
+                ConcurrentExecPoolWorkStealing(
+                    TSize concurrentExecutionCount) :
+                    m_vupWorkers(),
+                    m_vConcurrentExecs(),
+                    m_spFreeList(std::make_shared<FreeList>()),
+                    m_taskCount(0u),
+                    m_sleepingCount(0u),
+                    m_nextInbox(0u),
+                    m_mtxWakeup(),
+                    m_cvWakeup(),
+                    m_bShutdownFlag(false)
+                {
+                    if(concurrentExecutionCount < 1)
+                    {
+                        throw std::invalid_argument("The argument 'concurrentExecutionCount' has to be greate or equal to one!");
+                    }
+
+                    // All workers have to exist before the first concurrent executor starts stealing.
+                    m_vupWorkers.reserve(static_cast<std::size_t>(concurrentExecutionCount));
+                    for(TSize concurrentExec(0u); concurrentExec < concurrentExecutionCount; ++concurrentExec)
+                    {
+                        m_vupWorkers.emplace_back(new Worker(this));
+                    }
+
+                    m_vConcurrentExecs.reserve(static_cast<std::size_t>(concurrentExecutionCount));
+
+                    // Create all concurrent executors.
+                    for(std::size_t concurrentExec(0u); concurrentExec < m_vupWorkers.size(); ++concurrentExec)
+                    {
+                        m_vConcurrentExecs.emplace_back(std::bind(&ConcurrentExecPoolWorkStealing::concurrentExecFn, this, concurrentExec));
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                ConcurrentExecPoolWorkStealing(ConcurrentExecPoolWorkStealing const &) = delete;
+                //-----------------------------------------------------------------------------
+                ConcurrentExecPoolWorkStealing(ConcurrentExecPoolWorkStealing &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ConcurrentExecPoolWorkStealing const &) -> ConcurrentExecPoolWorkStealing & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ConcurrentExecPoolWorkStealing &&) -> ConcurrentExecPoolWorkStealing & = delete;
+
+                //-----------------------------------------------------------------------------
+                //! Completes any currently running task normally.
+                //! Signals a std::runtime_error exception to any other tasks that was not able to run.
+                ~ConcurrentExecPoolWorkStealing()
+                {
+                    {
+                        std::unique_lock<TMutex> lock(m_mtxWakeup);
+
+                        // Signal that concurrent executors should not perform any new work
+                        m_bShutdownFlag = true;
+                    }
+
+                    m_cvWakeup.notify_all();
+
+                    joinAllConcurrentExecs();
+
+                    // Signal to each incomplete task that it will not complete due to pool destruction.
+                    // The concurrent executors have been joined so the deques can be accessed from this thread.
+                    for(auto && upWorker : m_vupWorkers)
+                    {
+                        ITaskPkg * pTaskPackage(nullptr);
+                        while(upWorker->m_dqTasks.steal(pTaskPackage) || upWorker->m_qInbox.pop(pTaskPackage))
+                        {
+                            auto const except(std::runtime_error("Could not perform task before ConcurrentExecPool destruction"));
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_CUDA_DEVICE)
+                            pTaskPackage->setException(std::make_exception_ptr(except));
+#endif
+                            pTaskPackage->destroy();
+                        }
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Runs the given function on one of the pool.
+                //! NOTE: In contrast to ConcurrentExecPool, the tasks are not guaranteed to start in First In First Out (FIFO) order.
+                //!
+                //! \tparam TFnObj   The function type.
+                //! \param task     Function object to be called on the pool.
+                //!                 Takes an arbitrary number of arguments and arbitrary return type.
+                //! \tparam TArgs   The argument types pack.
+                //! \param args     Arguments for task, cannot be moved.
+                //!                 If such parameters must be used, use a lambda and capture via move then move the lambda.
+                //!
+                //! \return Signals when the task has completed with either success or an exception.
+                //!         Also results in an exception if the pool is destroyed before execution has begun.
+                template<
+                    typename TFnObj,
+                    typename ... TArgs>
+                auto enqueueTask(
+                    TFnObj && task,
+                    TArgs && ... args)
+#ifdef BOOST_NO_CXX14_RETURN_TYPE_DEDUCTION
+                -> decltype(std::declval<TPromise<decltype(task(args...))>>().get_future())
+#endif
+                {
+                    auto boundTask(std::bind(task, args...));
+
+                    // Return type of the function object, can be void via specialization of TaskPkg.
+                    using FnObjReturn = decltype(task(args...));
+                    using TaskPackage = TaskPkg<TPromise, decltype(boundTask), FnObjReturn>;
+
+                    auto const pTaskPackage(createTaskPkg<TaskPackage>(m_spFreeList, std::move(boundTask)));
+
+                    auto future(pTaskPackage->m_Promise.get_future());
+
+                    // Tasks enqueued by a concurrent executor of this pool are pushed onto its own deque without locking.
+                    auto const pCurrentWorker(getCurrentWorker());
+                    if(pCurrentWorker && (pCurrentWorker->m_pPool == this))
+                    {
+                        pCurrentWorker->m_dqTasks.push(pTaskPackage);
+                    }
+                    else
+                    {
+                        auto const inboxIdx(m_nextInbox.fetch_add(1u, std::memory_order_relaxed) % m_vupWorkers.size());
+                        m_vupWorkers[inboxIdx]->m_qInbox.push(pTaskPackage);
+                    }
+
+                    m_taskCount.fetch_add(1u);
+
+                    // Only pay for the mutex if there is someone to wake up.
+                    // The sequentially consistent accesses to m_taskCount and m_sleepingCount guarantee that either this thread sees the sleeper
+                    // or the sleeper sees the new task before going to sleep.
+                    if(m_sleepingCount.load() > 0u)
+                    {
+                        {
+                            std::lock_guard<TMutex> lock(m_mtxWakeup);
+                        }
+                        m_cvWakeup.notify_one();
+                    }
+
+                    return future;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The number of concurrent executors available.
+                auto getConcurrentExecutionCount() const
+                -> TSize
+                {
+                    return static_cast<TSize>(m_vConcurrentExecs.size());
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If there are no tasks waiting to be executed.
+                auto isQueueEmpty() const
+                -> bool
+                {
+                    return m_taskCount.load() == 0u;
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! \return The worker state of the current thread or nullptr if it is not a concurrent executor of any pool of this type.
+                static auto getCurrentWorker()
+                -> Worker * &
+                {
+                    static thread_local Worker * pWorker(nullptr);
+                    return pWorker;
+                }
+                //-----------------------------------------------------------------------------
+                //! The function the concurrent executors are executing.
+                void concurrentExecFn(
+                    std::size_t const workerIdx)
+                {
+                    auto & worker(*m_vupWorkers[workerIdx]);
+                    getCurrentWorker() = &worker;
+
+                    std::size_t yieldCount(0u);
+
+                    // Checks whether pool is being destroyed, if so, stop running (lazy check without mutex).
+                    while(!m_bShutdownFlag)
+                    {
+                        ITaskPkg * pTaskPackage(nullptr);
+
+                        if(findTask(workerIdx, pTaskPackage))
+                        {
+                            m_taskCount.fetch_sub(1u);
+                            pTaskPackage->runTask();
+                            pTaskPackage->destroy();
+                            yieldCount = 0u;
+                        }
+                        else if(yieldCount < s_yieldCountMax)
+                        {
+                            ++yieldCount;
+                            TYield::yield();
+                        }
+                        else
+                        {
+                            std::unique_lock<TMutex> lock(m_mtxWakeup);
+                            m_sleepingCount.fetch_add(1u);
+                            m_cvWakeup.wait(lock, [this]() { return (m_taskCount.load() > 0u) || m_bShutdownFlag; });
+                            m_sleepingCount.fetch_sub(1u);
+                            yieldCount = 0u;
+                        }
+                    }
+
+                    getCurrentWorker() = nullptr;
+                }
+                //-----------------------------------------------------------------------------
+                //! Searches for a task in the own deque and inbox first and then steals from the other concurrent executors.
+                auto findTask(
+                    std::size_t const workerIdx,
+                    ITaskPkg * & pTaskPackage)
+                -> bool
+                {
+                    auto & worker(*m_vupWorkers[workerIdx]);
+                    if(worker.m_dqTasks.pop(pTaskPackage) || worker.m_qInbox.pop(pTaskPackage))
+                    {
+                        return true;
+                    }
+
+                    auto const workerCount(m_vupWorkers.size());
+                    for(std::size_t i(1u); i < workerCount; ++i)
+                    {
+                        auto & victim(*m_vupWorkers[(workerIdx + i) % workerCount]);
+                        if(victim.m_dqTasks.steal(pTaskPackage) || victim.m_qInbox.pop(pTaskPackage))
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                //-----------------------------------------------------------------------------
+                //! Joins all concurrent executors.
+                void joinAllConcurrentExecs()
+                {
+                    for(auto && concurrentExec : m_vConcurrentExecs)
+                    {
+                        concurrentExec.join();
+                    }
+                }
+
+            private:
+                std::vector<std::unique_ptr<Worker>> m_vupWorkers;
+                std::vector<TConcurrentExec> m_vConcurrentExecs;
+                std::shared_ptr<FreeList> m_spFreeList;         //!< The memory used for the task packages and their promises.
+
+                std::atomic<std::size_t> m_taskCount;           //!< The number of enqueued tasks not yet taken by a concurrent executor.
+                std::atomic<std::size_t> m_sleepingCount;       //!< The number of concurrent executors waiting on the condition variable.
+                std::atomic<std::size_t> m_nextInbox;
+
+                TMutex m_mtxWakeup;
+                TCondVar m_cvWakeup;
+                std::atomic<bool> m_bShutdownFlag;
+            };
+
+            template<
+                typename TSize,
+                typename TConcurrentExec,
+                template<typename TFnObjReturn> class TPromise,
+                typename TYield,
+                typename TMutex,
+                typename TCondVar>
+            constexpr std::size_t ConcurrentExecPoolWorkStealing<TSize, TConcurrentExec, TPromise, TYield, TMutex, TCondVar>::s_yieldCountMax;
+        }
+    }
+}
@@ -0,0 +1,205 @@
+/**
+* \file
+* Copyright 2017 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A thread safe free list of equally sized memory blocks.
+            //!
+            //! Blocks are allocated from the heap on demand and are only given back to the heap when the free list is destroyed.
+            //! Requests larger than the block size are directly forwarded to the heap.
+            class FreeList final
+            {
+                //#############################################################################
+                //! The link stored inside of a free block.
+                struct Node
+                {
+                    Node * m_pNext;
+                };
+
+            public:
+                //! The size of the memory blocks.
+                static constexpr std::size_t s_blockSizeBytes = 256u;
+
+                //-----------------------------------------------------------------------------
+                FreeList() :
+                    m_mtx(),
+                    m_pHead(nullptr)
+                {}
+                //-----------------------------------------------------------------------------
+                FreeList(FreeList const &) = delete;
+                //-----------------------------------------------------------------------------
+                FreeList(FreeList &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(FreeList const &) -> FreeList & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(FreeList &&) -> FreeList & = delete;
+                //-----------------------------------------------------------------------------
+                ~FreeList()
+                {
+                    while(m_pHead)
+                    {
+                        auto const pNode(m_pHead);
+                        m_pHead = pNode->m_pNext;
+                        ::operator delete(static_cast<void *>(pNode));
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return A memory block of at least the given size.
+                auto allocate(
+                    std::size_t const sizeBytes)
+                -> void *
+                {
+                    if(sizeBytes > s_blockSizeBytes)
+                    {
+                        return ::operator new(sizeBytes);
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(m_mtx);
+                        if(m_pHead)
+                        {
+                            auto const pNode(m_pHead);
+                            m_pHead = pNode->m_pNext;
+                            return static_cast<void *>(pNode);
+                        }
+                    }
+
+                    return ::operator new(static_cast<std::size_t>(s_blockSizeBytes));
+                }
+                //-----------------------------------------------------------------------------
+                //! Returns the memory block allocated with the given size to the free list.
+                auto deallocate(
+                    void * const p,
+                    std::size_t const sizeBytes) noexcept
+                -> void
+                {
+                    if(sizeBytes > s_blockSizeBytes)
+                    {
+                        ::operator delete(p);
+                        return;
+                    }
+
+                    auto const pNode(static_cast<Node *>(p));
+
+                    std::lock_guard<std::mutex> lock(m_mtx);
+                    pNode->m_pNext = m_pHead;
+                    m_pHead = pNode;
+                }
+
+            private:
+                std::mutex m_mtx;
+                Node * m_pHead;
+            };
+
+            //#############################################################################
+            //! A standard conforming allocator using a shared free list.
+            //!
+            //! The allocator keeps the free list alive. Therefore, objects allocated with it (for example promise shared states) can safely outlive the owner of the free list.
+            template<
+                typename T>
+            class FreeListAllocator
+            {
+                template<
+                    typename U>
+                friend class FreeListAllocator;
+
+            public:
+                using value_type = T;
+
+                //-----------------------------------------------------------------------------
+                explicit FreeListAllocator(
+                    std::shared_ptr<FreeList> const & spFreeList) :
+                        m_spFreeList(spFreeList)
+                {}
+                //-----------------------------------------------------------------------------
+                template<
+                    typename U>
+                FreeListAllocator(
+                    FreeListAllocator<U> const & other) :
+                        m_spFreeList(other.m_spFreeList)
+                {}
+
+                //-----------------------------------------------------------------------------
+                auto allocate(
+                    std::size_t const n)
+                -> T *
+                {
+                    // Over-aligned types can not be served by the free list.
+                    if(alignof(T) > alignof(std::max_align_t))
+                    {
+                        return static_cast<T *>(::operator new(n * sizeof(T)));
+                    }
+                    return static_cast<T *>(m_spFreeList->allocate(n * sizeof(T)));
+                }
+                //-----------------------------------------------------------------------------
+                auto deallocate(
+                    T * const p,
+                    std::size_t const n) noexcept
+                -> void
+                {
+                    if(alignof(T) > alignof(std::max_align_t))
+                    {
+                        ::operator delete(static_cast<void *>(p));
+                        return;
+                    }
+                    m_spFreeList->deallocate(static_cast<void *>(p), n * sizeof(T));
+                }
+
+                //-----------------------------------------------------------------------------
+                template<
+                    typename U>
+                auto operator==(
+                    FreeListAllocator<U> const & rhs) const
+                -> bool
+                {
+                    return m_spFreeList == rhs.m_spFreeList;
+                }
+                //-----------------------------------------------------------------------------
+                template<
+                    typename U>
+                auto operator!=(
+                    FreeListAllocator<U> const & rhs) const
+                -> bool
+                {
+                    return !((*this) == rhs);
+                }
+
+            private:
+                std::shared_ptr<FreeList> m_spFreeList;
+            };
+        }
+    }
+}
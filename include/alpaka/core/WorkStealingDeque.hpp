@@ -0,0 +1,229 @@
+/**
+* \file
+* Copyright 2017 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A lock-free Chase-Lev work-stealing deque.
+            //!
+            //! Only the owner is allowed to push and pop at the bottom. Any thread can steal from the top.
+            //! The memory orderings follow "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al., 2013).
+            //! Buffers replaced while growing are kept alive until the deque is destroyed because thieves may still read from them.
+            //!
+            //! \tparam T The element type. It has to be a pointer so that it can be read and written atomically.
+            template<
+                typename T>
+            class WorkStealingDeque final
+            {
+                static_assert(
+                    std::is_pointer<T>::value,
+                    "The WorkStealingDeque can only store pointers!");
+
+                //#############################################################################
+                //! The circular buffer holding the elements.
+                class Buffer final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    explicit Buffer(
+                        std::size_t const capacity) :
+                            m_capacity(capacity),
+                            m_upElems(new std::atomic<T>[capacity])
+                    {}
+                    //-----------------------------------------------------------------------------
+                    auto capacity() const
+                    -> std::size_t
+                    {
+                        return m_capacity;
+                    }
+                    //-----------------------------------------------------------------------------
+                    auto get(
+                        std::int64_t const i) const
+                    -> T
+                    {
+                        return m_upElems[static_cast<std::size_t>(i) & (m_capacity - 1u)].load(std::memory_order_relaxed);
+                    }
+                    //-----------------------------------------------------------------------------
+                    auto put(
+                        std::int64_t const i,
+                        T const t)
+                    -> void
+                    {
+                        m_upElems[static_cast<std::size_t>(i) & (m_capacity - 1u)].store(t, std::memory_order_relaxed);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return A buffer with twice the capacity containing the elements in [top, bottom).
+                    auto grow(
+                        std::int64_t const top,
+                        std::int64_t const bottom) const
+                    -> Buffer *
+                    {
+                        auto const pBuffer(new Buffer(m_capacity * 2u));
+                        for(std::int64_t i(top); i < bottom; ++i)
+                        {
+                            pBuffer->put(i, get(i));
+                        }
+                        return pBuffer;
+                    }
+
+                private:
+                    std::size_t const m_capacity;
+                    std::unique_ptr<std::atomic<T>[]> m_upElems;
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param capacity The initial capacity. Has to be a power of two.
+                explicit WorkStealingDeque(
+                    std::size_t const capacity = 64u) :
+                        m_top(0),
+                        m_bottom(0),
+                        m_pBuffer(nullptr),
+                        m_vupBuffers()
+                {
+                    m_vupBuffers.emplace_back(new Buffer(capacity));
+                    m_pBuffer.store(m_vupBuffers.back().get(), std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                WorkStealingDeque(WorkStealingDeque const &) = delete;
+                //-----------------------------------------------------------------------------
+                WorkStealingDeque(WorkStealingDeque &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(WorkStealingDeque const &) -> WorkStealingDeque & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(WorkStealingDeque &&) -> WorkStealingDeque & = delete;
+                //-----------------------------------------------------------------------------
+                ~WorkStealingDeque() = default;
+
+                //-----------------------------------------------------------------------------
+                //! \return If the deque is empty. This is only a snapshot when called concurrently to other operations.
+                auto empty() const
+                -> bool
+                {
+                    return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                //! Pushes the given value onto the bottom of the deque.
+                //! NOTE: Must only be called by the owner.
+                auto push(
+                    T const t)
+                -> void
+                {
+                    auto const bottom(m_bottom.load(std::memory_order_relaxed));
+                    auto const top(m_top.load(std::memory_order_acquire));
+                    auto pBuffer(m_pBuffer.load(std::memory_order_relaxed));
+
+                    if(bottom - top > static_cast<std::int64_t>(pBuffer->capacity()) - 1)
+                    {
+                        pBuffer = pBuffer->grow(top, bottom);
+                        m_vupBuffers.emplace_back(pBuffer);
+                        m_pBuffer.store(pBuffer, std::memory_order_release);
+                    }
+
+                    pBuffer->put(bottom, t);
+                    std::atomic_thread_fence(std::memory_order_release);
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                //! Pops the value from the bottom of the deque.
+                //! NOTE: Must only be called by the owner.
+                //!
+                //! \return If a value has been popped.
+                auto pop(
+                    T & t)
+                -> bool
+                {
+                    auto const bottom(m_bottom.load(std::memory_order_relaxed) - 1);
+                    auto const pBuffer(m_pBuffer.load(std::memory_order_relaxed));
+                    m_bottom.store(bottom, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    auto top(m_top.load(std::memory_order_relaxed));
+
+                    if(top > bottom)
+                    {
+                        // The deque was empty.
+                        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                        return false;
+                    }
+
+                    t = pBuffer->get(bottom);
+                    if(top == bottom)
+                    {
+                        // This is the last element. Race against the thieves for it.
+                        bool const won(m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed));
+                        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                        return won;
+                    }
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //! Steals the value from the top of the deque.
+                //! Can be called by any thread.
+                //!
+                //! \return If a value has been stolen.
+                auto steal(
+                    T & t)
+                -> bool
+                {
+                    auto top(m_top.load(std::memory_order_acquire));
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    auto const bottom(m_bottom.load(std::memory_order_acquire));
+
+                    if(top >= bottom)
+                    {
+                        return false;
+                    }
+
+                    auto const pBuffer(m_pBuffer.load(std::memory_order_acquire));
+                    auto const value(pBuffer->get(top));
+                    if(!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    {
+                        // Lost the race against the owner or an other thief.
+                        return false;
+                    }
+                    t = value;
+                    return true;
+                }
+
+            private:
+                std::atomic<std::int64_t> m_top;
+                std::atomic<std::int64_t> m_bottom;
+                std::atomic<Buffer *> m_pBuffer;
+                std::vector<std::unique_ptr<Buffer>> m_vupBuffers;  //!< All buffers ever used. Only modified by the owner.
+            };
+        }
+    }
+}
@@ -26,6 +26,7 @@
 #include <alpaka/pltf/Traits.hpp>
 
 #include <alpaka/dev/cpu/SysInfo.hpp>
+#include <alpaka/dev/cpu/ThreadPool.hpp>
 
 #include <boost/core/ignore_unused.hpp>
 
@@ -76,7 +77,11 @@ namespace alpaka
                     friend stream::cpu::detail::StreamCpuAsyncImpl;  // StreamCpuAsyncImpl::~StreamCpuAsyncImpl calls UnregisterAsyncStream.
                 public:
                     //-----------------------------------------------------------------------------
-                    DevCpuImpl() = default;
+                    DevCpuImpl() :
+                        m_Mutex(),
+                        m_mapStreams(),
+                        m_spThreadPoolShared(getThreadPoolShared())
+                    {}
                     //-----------------------------------------------------------------------------
                     DevCpuImpl(DevCpuImpl const &) = default;
                     //-----------------------------------------------------------------------------
@@ -110,6 +115,13 @@ namespace alpaka
                         }
                         return vspStreams;
                     }
+                    //-----------------------------------------------------------------------------
+                    //! \return The thread pool used to execute the block threads of kernels on this device.
+                    ALPAKA_FN_HOST auto GetThreadPoolShared() const
+                    -> ThreadPoolShared &
+                    {
+                        return *m_spThreadPoolShared;
+                    }
 
                 private:
                     //-----------------------------------------------------------------------------
@@ -153,6 +165,8 @@ namespace alpaka
                 private:
                     std::mutex mutable m_Mutex;
                     std::map<stream::cpu::detail::StreamCpuAsyncImpl *, std::weak_ptr<stream::cpu::detail::StreamCpuAsyncImpl>> m_mapStreams;
+
+                    std::shared_ptr<ThreadPoolShared> m_spThreadPoolShared;
                 };
             }
         }
@@ -0,0 +1,140 @@
+/**
+* \file
+* Copyright 2017 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/ConcurrentExecPool.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace alpaka
+{
+    namespace dev
+    {
+        namespace cpu
+        {
+            namespace detail
+            {
+                //#############################################################################
+                //! The thread pool executing the block threads of kernels on the CPU device.
+                //!
+                //! The threads wait on a condition variable instead of yielding because the pool is kept alive between kernel launches.
+                using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
+                    std::size_t,
+                    std::thread,                // The concurrent execution type.
+                    std::promise,               // The promise type.
+                    void,                       // The type yielding the current concurrent execution.
+                    std::mutex,                 // The mutex type to use. Only required if TisYielding is false.
+                    std::condition_variable,    // The condition variable type to use. Only required if TisYielding is false.
+                    false>;                     // If the threads should yield.
+
+                //#############################################################################
+                //! The thread pool shared by all CPU device handles.
+                //!
+                //! The threads are created lazily on first use and the pool only ever grows to the largest number of threads requested.
+                //! Only one kernel can use the pool at a time.
+                class ThreadPoolShared
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    ThreadPoolShared() :
+                        m_mtxUse(),
+                        m_upThreadPool()
+                    {}
+                    //-----------------------------------------------------------------------------
+                    ThreadPoolShared(ThreadPoolShared const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    ThreadPoolShared(ThreadPoolShared &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(ThreadPoolShared const &) -> ThreadPoolShared & = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(ThreadPoolShared &&) -> ThreadPoolShared & = delete;
+                    //-----------------------------------------------------------------------------
+                    ~ThreadPoolShared() = default;
+
+                    //-----------------------------------------------------------------------------
+                    //! Tries to get exclusive access to the pool and makes sure it contains at least the given number of threads.
+                    //!
+                    //! \return The lock guarding the exclusive access. It does not own the mutex if the pool is already in use.
+                    ALPAKA_FN_HOST auto tryLock(
+                        std::size_t const threadCount)
+                    -> std::unique_lock<std::mutex>
+                    {
+                        std::unique_lock<std::mutex> lock(m_mtxUse, std::try_to_lock);
+
+                        if(lock.owns_lock())
+                        {
+                            if(!m_upThreadPool)
+                            {
+                                m_upThreadPool.reset(new ThreadPool(threadCount));
+                            }
+                            else
+                            {
+                                m_upThreadPool->reserveConcurrentExecs(threadCount);
+                            }
+                        }
+
+                        return lock;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The thread pool. Only valid while holding the lock returned by tryLock.
+                    ALPAKA_FN_HOST auto getThreadPool()
+                    -> ThreadPool &
+                    {
+                        return *m_upThreadPool;
+                    }
+
+                private:
+                    std::mutex m_mtxUse;
+                    std::unique_ptr<ThreadPool> m_upThreadPool;
+                };
+
+                //-----------------------------------------------------------------------------
+                //! All CPU device handles represent the same physical device and therefore share a single thread pool.
+                //! The pool lives as long as any device handle does.
+                //!
+                //! \return The thread pool shared by all CPU device handles.
+                ALPAKA_FN_HOST inline auto getThreadPoolShared()
+                -> std::shared_ptr<ThreadPoolShared>
+                {
+                    static std::mutex mtx;
+                    static std::weak_ptr<ThreadPoolShared> wpThreadPool;
+
+                    std::lock_guard<std::mutex> lock(mtx);
+
+                    auto spThreadPool(wpThreadPool.lock());
+                    if(!spThreadPool)
+                    {
+                        spThreadPool = std::make_shared<ThreadPoolShared>();
+                        wpThreadPool = spThreadPool;
+                    }
+                    return spThreadPool;
+                }
+            }
+        }
+    }
+}
@@ -34,7 +34,9 @@
 // Implementation details.
 #include <alpaka/acc/AccCpuThreads.hpp>
 #include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/cpu/ThreadPool.hpp>
 #include <alpaka/kernel/Traits.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
 #include <alpaka/core/ConcurrentExecPool.hpp>
@@ -49,6 +51,8 @@
 #include <tuple>
 #include <type_traits>
 #include <future>
+#include <memory>
+#include <mutex>
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
     #include <iostream>
 #endif
@@ -69,26 +73,7 @@ namespace alpaka
         {
         private:
             //#############################################################################
-            //! The type given to the ConcurrentExecPool for yielding the current thread.
-            struct ThreadPoolYield
-            {
-                //-----------------------------------------------------------------------------
-                //! Yields the current thread.
-                ALPAKA_FN_HOST static auto yield()
-                -> void
-                {
-                    std::this_thread::yield();
-                }
-            };
-            //#############################################################################
-            // When using the thread pool the threads are yielding because this is faster.
-            // Using condition variables and going to sleep is very costly for real threads.
-            // Especially when the time to wait is really short (syncBlockThreads) yielding is much faster.
-            using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
-                TSize,
-                std::thread,        // The concurrent execution type.
-                std::promise,       // The promise type.
-                ThreadPoolYield>;   // The type yielding the current concurrent execution.
+            using ThreadPool = dev::cpu::detail::ThreadPool;
 
         public:
             //-----------------------------------------------------------------------------
@@ -154,8 +139,22 @@ namespace alpaka
                     *static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this),
                     blockSharedMemDynSizeBytes);
 
-                auto const blockThreadCount(blockThreadExtent.prod());
-                ThreadPool threadPool(blockThreadCount);
+                auto const blockThreadCount(static_cast<std::size_t>(blockThreadExtent.prod()));
+
+                // Reuse the long-lived thread pool of the device to avoid creating and joining threads on each launch.
+                // If it is already in use by a kernel running concurrently in a different stream, a temporary pool is created.
+                auto const devCpu(pltf::getDevByIdx<pltf::PltfCpu>(0u));
+                auto & threadPoolShared(devCpu.m_spDevCpuImpl->GetThreadPoolShared());
+                auto const lockThreadPoolShared(threadPoolShared.tryLock(blockThreadCount));
+                std::unique_ptr<ThreadPool> upThreadPoolTemp;
+                if(!lockThreadPoolShared.owns_lock())
+                {
+                    upThreadPoolTemp.reset(new ThreadPool(blockThreadCount));
+                }
+                ThreadPool & threadPool(
+                    lockThreadPoolShared.owns_lock()
+                    ? threadPoolShared.getThreadPool()
+                    : *upThreadPoolTemp);
 
                 // Bind the kernel and its arguments to the grid block function.
                 auto const boundGridBlockExecHost(
@@ -0,0 +1,231 @@
+/**
+ * \file
+ * Copyright 2017 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * alpaka is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * alpaka is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with alpaka.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <alpaka/alpaka.hpp>
+#include <alpaka/test/acc/Acc.hpp>
+#include <alpaka/test/stream/Stream.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <typeinfo>
+#include <vector>
+
+//#############################################################################
+//! A kernel doing (nearly) nothing so that the measured time is dominated by the launch overhead.
+class LaunchOverheadKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! Increments the element belonging to the current thread.
+    //!
+    //! \tparam TAcc The type of the accelerator the kernel is executed on..
+    //! \param acc The accelerator the kernel is executed on.
+    //! \param counters The counters incremented by the threads.
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TSize>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        TSize * const counters) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+
+        ++counters[gridThreadIdx];
+    }
+};
+
+//#############################################################################
+//! Measures the time required to launch a kernel for a given number of threads per block.
+struct LaunchOverheadTester
+{
+    template<
+        typename TAcc,
+        typename TSize>
+    auto operator()(
+        TSize const & blockThreadCount,
+        TSize const & launchCount)
+    -> void
+    {
+        using DevAcc = alpaka::dev::Dev<TAcc>;
+        using PltfAcc = alpaka::pltf::Pltf<DevAcc>;
+        using StreamAcc = alpaka::test::stream::DefaultStream<DevAcc>;
+        using PltfHost = alpaka::pltf::PltfCpu;
+
+        // Create the kernel function object.
+        LaunchOverheadKernel kernel;
+
+        // Get the host device.
+        auto const devHost(
+            alpaka::pltf::getDevByIdx<PltfHost>(0u));
+
+        // Select a device to execute on.
+        auto const devAcc(
+            alpaka::pltf::getDevByIdx<PltfAcc>(0u));
+
+        // Skip the accelerators not supporting the requested block size.
+        auto const accDevProps(alpaka::acc::getAccDevProps<TAcc>(devAcc));
+        if((blockThreadCount > accDevProps.m_blockThreadCountMax)
+            || (blockThreadCount > accDevProps.m_blockThreadExtentMax[0u]))
+        {
+            std::cout
+                << "LaunchOverheadTester("
+                << " accelerator: " << alpaka::acc::getAccName<TAcc>()
+                << ", blockThreadCount: " << blockThreadCount
+                << ") skipped: The accelerator supports at most " << accDevProps.m_blockThreadCountMax << " threads per block."
+                << std::endl;
+            return;
+        }
+
+        // Get a stream on this device.
+        StreamAcc stream(devAcc);
+
+        // Launch a single block so that the time is not dominated by the number of blocks executed.
+        alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, TSize> const workDiv(
+            static_cast<TSize>(1u),
+            blockThreadCount,
+            static_cast<TSize>(1u));
+
+        std::cout
+            << "LaunchOverheadTester("
+            << " accelerator: " << alpaka::acc::getAccName<TAcc>()
+            << ", kernel: " << typeid(kernel).name()
+            << ", workDiv: " << workDiv
+            << ", launchCount: " << launchCount
+            << ")" << std::endl;
+
+        alpaka::vec::Vec<alpaka::dim::DimInt<1u>, TSize> const extent(
+            blockThreadCount);
+
+        // Allocate and initialize the counters.
+        auto memBufHost(alpaka::mem::buf::alloc<TSize, TSize>(devHost, extent));
+        auto memBufAcc(alpaka::mem::buf::alloc<TSize, TSize>(devAcc, extent));
+        for(TSize i(0u); i < blockThreadCount; ++i)
+        {
+            alpaka::mem::view::getPtrNative(memBufHost)[i] = static_cast<TSize>(0u);
+        }
+        alpaka::mem::view::copy(stream, memBufAcc, memBufHost, extent);
+
+        // Create the executor task.
+        auto const exec(alpaka::exec::create<TAcc>(
+            workDiv,
+            kernel,
+            alpaka::mem::view::getPtrNative(memBufAcc)));
+
+        // Launch the kernel once before measuring so that one-time initializations are not taken into account.
+        alpaka::stream::enqueue(stream, exec);
+        alpaka::wait::wait(stream);
+
+        auto const tpStart(std::chrono::high_resolution_clock::now());
+
+        for(TSize i(0u); i < launchCount; ++i)
+        {
+            alpaka::stream::enqueue(stream, exec);
+        }
+        alpaka::wait::wait(stream);
+
+        auto const tpEnd(std::chrono::high_resolution_clock::now());
+
+        auto const durElapsedUs(std::chrono::duration_cast<std::chrono::microseconds>(tpEnd - tpStart).count());
+        std::cout << "Execution time: "
+            << durElapsedUs << " us total, "
+            << static_cast<double>(durElapsedUs) / static_cast<double>(launchCount) << " us per launch"
+            << std::endl;
+
+        // Copy back the result.
+        alpaka::mem::view::copy(stream, memBufHost, memBufAcc, extent);
+        alpaka::wait::wait(stream);
+
+        bool resultCorrect(true);
+        auto const pHostResultData(alpaka::mem::view::getPtrNative(memBufHost));
+        for(TSize i(0u); i < blockThreadCount; ++i)
+        {
+            auto const & val(pHostResultData[i]);
+            auto const correctResult(launchCount + static_cast<TSize>(1u));
+            if(val != correctResult)
+            {
+                std::cout << "C[" << i << "] == " << val << " != " << correctResult << std::endl;
+                resultCorrect = false;
+            }
+        }
+
+        if(resultCorrect)
+        {
+            std::cout << "Execution results correct!" << std::endl;
+        }
+
+        allResultsCorrect = allResultsCorrect && resultCorrect;
+    }
+
+public:
+    bool allResultsCorrect = true;
+};
+
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                          alpaka launch overhead test                           " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+        // Logs the enabled accelerators.
+        alpaka::test::acc::writeEnabledAccs<alpaka::dim::DimInt<1u>, std::size_t>(std::cout);
+
+        std::cout << std::endl;
+
+        LaunchOverheadTester launchOverheadTester;
+
+#ifdef ALPAKA_CI
+        std::size_t const launchCount(10u);
+#else
+        std::size_t const launchCount(1000u);
+#endif
+
+        // For different block sizes.
+        for(std::size_t blockThreadCount : {1u, 8u, 64u})
+        {
+            std::cout << std::endl;
+
+            // Execute the kernel on all enabled accelerators.
+            alpaka::meta::forEachType<
+                alpaka::test::acc::EnabledAccs<alpaka::dim::DimInt<1u>, std::size_t>>(
+                    launchOverheadTester,
+                    blockThreadCount,
+                    launchCount);
+        }
+        return launchOverheadTester.allResultsCorrect ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,173 @@
+/**
+ * \file
+ * Copyright 2017 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * alpaka is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * alpaka is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with alpaka.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//#############################################################################
+//! The type given to the pools for yielding the current thread.
+struct ThreadYield
+{
+    //-----------------------------------------------------------------------------
+    static auto yield()
+    -> void
+    {
+        std::this_thread::yield();
+    }
+};
+
+//#############################################################################
+//! The pool using a single mutex protected queue.
+using PoolQueue = alpaka::core::detail::ConcurrentExecPool<
+    std::size_t,
+    std::thread,
+    std::promise,
+    void,
+    std::mutex,
+    std::condition_variable,
+    false>;
+
+//#############################################################################
+//! The pool using the work-stealing scheduler.
+using PoolWorkStealing = alpaka::core::detail::ConcurrentExecPoolWorkStealing<
+    std::size_t,
+    std::thread,
+    std::promise,
+    ThreadYield,
+    std::mutex,
+    std::condition_variable>;
+
+//-----------------------------------------------------------------------------
+//! Measures the number of tasks per second the given pool can execute.
+//! There is one producer thread per concurrent executor each enqueuing the same number of tiny tasks.
+//!
+//! \return If all tasks have been executed.
+template<
+    typename TPool>
+auto measureTaskThroughput(
+    std::string const & poolName,
+    std::size_t const workerCount,
+    std::size_t const taskCountPerProducer)
+-> bool
+{
+    std::atomic<std::size_t> executedTaskCount(0u);
+
+    TPool pool(workerCount);
+
+    auto const tpStart(std::chrono::high_resolution_clock::now());
+
+    std::vector<std::thread> producers;
+    for(std::size_t producerIdx(0u); producerIdx < workerCount; ++producerIdx)
+    {
+        producers.emplace_back(
+            [&pool, &executedTaskCount, taskCountPerProducer]()
+            {
+                std::vector<std::future<void>> futures;
+                futures.reserve(taskCountPerProducer);
+                for(std::size_t i(0u); i < taskCountPerProducer; ++i)
+                {
+                    futures.emplace_back(
+                        pool.enqueueTask(
+                            [&executedTaskCount]() noexcept
+                            {
+                                executedTaskCount.fetch_add(1u, std::memory_order_relaxed);
+                            }));
+                }
+                for(auto && future : futures)
+                {
+                    future.wait();
+                }
+            });
+    }
+    for(auto && producer : producers)
+    {
+        producer.join();
+    }
+
+    auto const tpEnd(std::chrono::high_resolution_clock::now());
+
+    auto const taskCount(workerCount * taskCountPerProducer);
+    auto const durElapsedUs(std::chrono::duration_cast<std::chrono::microseconds>(tpEnd - tpStart).count());
+    std::cout
+        << poolName
+        << " workers: " << workerCount
+        << ", tasks: " << taskCount
+        << ", time: " << durElapsedUs << " us"
+        << ", tasks/s: " << static_cast<double>(taskCount) / (static_cast<double>(durElapsedUs) * 1.0e-6)
+        << std::endl;
+
+    return executedTaskCount.load() == taskCount;
+}
+
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                          alpaka task throughput test                           " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#ifdef ALPAKA_CI
+        std::size_t const taskCountPerProducer(1000u);
+#else
+        std::size_t const taskCountPerProducer(100000u);
+#endif
+
+        bool allResultsCorrect(true);
+
+        // For different numbers of concurrent executors.
+        for(std::size_t workerCount : {1u, 2u, 4u, 8u})
+        {
+            allResultsCorrect = measureTaskThroughput<PoolQueue>("ConcurrentExecPool            ", workerCount, taskCountPerProducer) && allResultsCorrect;
+            allResultsCorrect = measureTaskThroughput<PoolWorkStealing>("ConcurrentExecPoolWorkStealing", workerCount, taskCountPerProducer) && allResultsCorrect;
+        }
+
+        if(allResultsCorrect)
+        {
+            std::cout << "Execution results correct!" << std::endl;
+        }
+
+        return allResultsCorrect ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,194 @@
+/**
+ * \file
+ * Copyright 2017 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * alpaka is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * alpaka is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with alpaka.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// \Hack: Boost.MPL defines BOOST_MPL_CFG_GPU_ENABLED to __host__ __device__ if nvcc is used.
+// BOOST_AUTO_TEST_CASE_TEMPLATE and its internals are not GPU enabled but is using boost::mpl::for_each internally.
+// For each template parameter this leads to:
+// /home/travis/build/boost/boost/mpl/for_each.hpp(78): warning: calling a __host__ function from a __host__ __device__ function is not allowed
+// because boost::mpl::for_each has the BOOST_MPL_CFG_GPU_ENABLED attribute but the test internals are pure host methods.
+// Because we do not use MPL within GPU code here, we can disable the MPL GPU support.
+#define BOOST_MPL_CFG_GPU_ENABLED
+
+#include <alpaka/alpaka.hpp>
+
+#include <boost/predef.h>
+#if BOOST_COMP_CLANG
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wunused-parameter"
+#endif
+#include <boost/test/unit_test.hpp>
+#if BOOST_COMP_CLANG
+    #pragma clang diagnostic pop
+#endif
+
+#include <boost/mpl/vector.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <future>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! The number of calls to the global operator new within this test executable.
+static std::atomic<std::size_t> g_allocationCount(0u);
+
+//-----------------------------------------------------------------------------
+auto operator new(
+    std::size_t sizeBytes)
+-> void *
+{
+    g_allocationCount.fetch_add(1u, std::memory_order_relaxed);
+    if(auto const p = std::malloc(sizeBytes == 0u ? 1u : sizeBytes))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+//-----------------------------------------------------------------------------
+auto operator delete(
+    void * p) noexcept
+-> void
+{
+    std::free(p);
+}
+//-----------------------------------------------------------------------------
+auto operator delete(
+    void * p,
+    std::size_t) noexcept
+-> void
+{
+    std::free(p);
+}
+
+namespace
+{
+    //#############################################################################
+    struct ThreadYield
+    {
+        //-----------------------------------------------------------------------------
+        static auto yield()
+        -> void
+        {
+            std::this_thread::yield();
+        }
+    };
+
+    using TestPools = boost::mpl::vector<
+        alpaka::core::detail::ConcurrentExecPool<
+            std::size_t,
+            std::thread,
+            std::promise,
+            ThreadYield>,
+        alpaka::core::detail::ConcurrentExecPool<
+            std::size_t,
+            std::thread,
+            std::promise,
+            void,
+            std::mutex,
+            std::condition_variable,
+            false>,
+        alpaka::core::detail::ConcurrentExecPoolWorkStealing<
+            std::size_t,
+            std::thread,
+            std::promise,
+            ThreadYield,
+            std::mutex,
+            std::condition_variable>>;
+}
+
+BOOST_AUTO_TEST_SUITE(concurrentExecPool)
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE_TEMPLATE(
+    enqueueTaskShouldReturnTheResultOfTheTask,
+    TPool,
+    TestPools)
+{
+    TPool pool(2u);
+
+    auto future(pool.enqueueTask([](int const a, int const b){return a + b;}, 40, 2));
+
+    BOOST_REQUIRE_EQUAL(42, future.get());
+}
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE_TEMPLATE(
+    enqueueTaskShouldForwardExceptions,
+    TPool,
+    TestPools)
+{
+    TPool pool(1u);
+
+    auto future(pool.enqueueTask([](){throw std::runtime_error("task");}));
+
+    BOOST_REQUIRE_THROW(future.get(), std::runtime_error);
+}
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE_TEMPLATE(
+    enqueueTaskShouldNotAllocateInSteadyState,
+    TPool,
+    TestPools)
+{
+    std::size_t const warmUpTaskCount(16u);
+    std::size_t const steadyStateTaskCount(1000u);
+
+    TPool pool(1u);
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(warmUpTaskCount);
+
+    int counter(0);
+    auto const task([&counter](){++counter;});
+
+    // Fill the free list with more blocks than the steady state below will ever hold at once.
+    for(std::size_t i(0u); i < warmUpTaskCount; ++i)
+    {
+        futures.emplace_back(pool.enqueueTask(task));
+    }
+    for(auto && future : futures)
+    {
+        future.get();
+    }
+    futures.clear();
+
+    auto const allocationCountBefore(g_allocationCount.load());
+
+    for(std::size_t i(0u); i < steadyStateTaskCount; ++i)
+    {
+        pool.enqueueTask(task).get();
+    }
+
+    auto const allocationCountAfter(g_allocationCount.load());
+
+    BOOST_REQUIRE_EQUAL(
+        static_cast<int>(warmUpTaskCount + steadyStateTaskCount),
+        counter);
+    BOOST_REQUIRE_EQUAL(
+        allocationCountBefore,
+        allocationCountAfter);
+}
+
+BOOST_AUTO_TEST_SUITE_END()